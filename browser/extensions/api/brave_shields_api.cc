@@ -108,6 +108,15 @@ BraveShieldsHiddenClassIdSelectorsFunction::Run() {
   std::unique_ptr<brave_shields::HiddenClassIdSelectors::Params> params(
       brave_shields::HiddenClassIdSelectors::Params::Create(*args_));
   EXTENSION_FUNCTION_VALIDATE(params.get());
+
+  // Nothing can match without any classes or ids, so skip the engines.
+  if (params->classes.empty() && params->ids.empty()) {
+    auto result_list = std::make_unique<base::ListValue>();
+    result_list->Append(base::ListValue());
+    result_list->Append(base::ListValue());
+    return RespondNow(ArgumentList(std::move(result_list)));
+  }
+
   g_brave_browser_process->ad_block_service()->GetTaskRunner()
       ->PostTaskAndReplyWithResult(
           FROM_HERE,
@@ -192,6 +192,14 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
   scoped_refptr<base::SequencedTaskRunner> task_runner =
       g_brave_browser_process->ad_block_service()->GetTaskRunner();
 
+  // An IP literal has no canonical name to uncloak, so skip the DNS round trip
+  // and go straight to the adblock engine.
+  if (ctx->request_url.HostIsIPAddress()) {
+    ShouldBlockAdWithOptionalCname(task_runner, next_callback, ctx,
+                                   base::nullopt);
+    return;
+  }
+
   new AdblockCnameResolveHostClient(std::move(next_callback), task_runner, ctx);
 }
 
@@ -203,12 +211,20 @@ int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
 
   // If the following info isn't available, then proper content settings can't
   // be looked up, so do nothing.
-  if (ctx->tab_origin.is_empty() || !ctx->allow_brave_shields ||
-      ctx->allow_ads ||
+  if (ctx->tab_origin.is_empty() || !ctx->tab_origin.has_host() ||
+      !ctx->allow_brave_shields || ctx->allow_ads ||
       ctx->resource_type == BraveRequestInfo::kInvalidResourceType) {
     return net::OK;
   }
 
+  // The engine can never block these, so answer here rather than paying for
+  // the CNAME lookup and the adblock task runner hop.
+  if (!ctx->initiator_url.is_valid() ||
+      !(ctx->request_url.SchemeIsHTTPOrHTTPS() ||
+        ctx->request_url.SchemeIsWSOrWSS())) {
+    return net::OK;
+  }
+
   OnBeforeURLRequestAdBlockTP(next_callback, ctx);
 
   return net::ERR_IO_PENDING;
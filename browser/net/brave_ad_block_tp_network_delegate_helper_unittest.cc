@@ -32,3 +32,26 @@ TEST(BraveAdBlockTPNetworkDelegateHelperTest, EmptyRequestURL) {
   EXPECT_TRUE(request_info->new_url_spec.empty());
   EXPECT_EQ(rc, net::OK);
 }
+
+TEST(BraveAdBlockTPNetworkDelegateHelperTest, NonNetworkRequestURL) {
+  const GURL url("data:text/plain,composite_numbers_ftw");
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  request_info->tab_origin = GURL("https://brave.com/");
+  request_info->initiator_url = GURL("https://brave.com/");
+  request_info->resource_type = blink::mojom::ResourceType::kImage;
+  int rc =
+      OnBeforeURLRequest_AdBlockTPPreWork(ResponseCallback(), request_info);
+  EXPECT_TRUE(request_info->new_url_spec.empty());
+  EXPECT_EQ(rc, net::OK);
+}
+
+TEST(BraveAdBlockTPNetworkDelegateHelperTest, NoInitiatorURL) {
+  const GURL url("https://bradhatesprimes.brave.com/composite_numbers_ftw");
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  request_info->tab_origin = GURL("https://brave.com/");
+  request_info->resource_type = blink::mojom::ResourceType::kImage;
+  int rc =
+      OnBeforeURLRequest_AdBlockTPPreWork(ResponseCallback(), request_info);
+  EXPECT_TRUE(request_info->new_url_spec.empty());
+  EXPECT_EQ(rc, net::OK);
+}
@@ -100,3 +100,24 @@ TEST(BraveReferralsNetworkDelegateHelperTest,
   EXPECT_FALSE(headers.HasHeader("X-Brave-Partner"));
   EXPECT_EQ(rc, net::OK);
 }
+
+TEST(BraveReferralsNetworkDelegateHelperTest,
+     NoReplaceHeadersForDomainSuffixWithoutLabelBoundary) {
+  const GURL url("https://notmarketwatch.com");
+  base::JSONReader::ValueWithError referral_headers =
+      base::JSONReader::ReadAndReturnValueWithError(kTestReferralHeaders);
+  ASSERT_TRUE(referral_headers.value);
+  ASSERT_TRUE(referral_headers.value->is_list());
+
+  const base::ListValue* referral_headers_list = nullptr;
+  referral_headers.value->GetAsList(&referral_headers_list);
+
+  net::HttpRequestHeaders headers;
+  auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+  request_info->referral_headers_list = referral_headers_list;
+  int rc = brave::OnBeforeStartTransaction_ReferralsWork(
+      &headers, brave::ResponseCallback(), request_info);
+
+  EXPECT_FALSE(headers.HasHeader("X-Brave-Partner"));
+  EXPECT_EQ(rc, net::OK);
+}
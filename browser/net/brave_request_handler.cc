@@ -238,17 +238,19 @@ void BraveRequestHandler::RunNextCallback(
     return;
   }
 
-  // Continue processing callbacks until we hit one that returns PENDING
+  // Continue processing callbacks until we hit one that returns PENDING.
+  // Most callbacks complete synchronously, so bind the continuation once and
+  // share it between them rather than binding one per callback.
   int rv = net::OK;
+  const brave::ResponseCallback next_callback =
+      base::Bind(&BraveRequestHandler::RunNextCallback,
+                 weak_factory_.GetWeakPtr(), ctx);
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
     while (before_url_request_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
+      const brave::OnBeforeURLRequestCallback& callback =
           before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::Bind(&BraveRequestHandler::RunNextCallback,
-                     weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
         return;
@@ -260,11 +262,8 @@ void BraveRequestHandler::RunNextCallback(
   } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeStartTransactionCallback callback =
+      const brave::OnBeforeStartTransactionCallback& callback =
           before_start_transaction_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::Bind(&BraveRequestHandler::RunNextCallback,
-                     weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(ctx->headers, next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
         return;
@@ -275,11 +274,8 @@ void BraveRequestHandler::RunNextCallback(
     }
   } else if (ctx->event_type == brave::kOnHeadersReceived) {
     while (headers_received_callbacks_.size() != ctx->next_url_request_index) {
-      brave::OnHeadersReceivedCallback callback =
+      const brave::OnHeadersReceivedCallback& callback =
           headers_received_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::Bind(&BraveRequestHandler::RunNextCallback,
-                     weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(ctx->original_response_headers,
                         ctx->override_response_headers,
                         ctx->allowed_unsafe_redirect_url, next_callback, ctx);
@@ -9,9 +9,11 @@
 #include <string>
 #include <vector>
 
-#include "base/lazy_instance.h"
+#include "base/containers/flat_set.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/shield_exceptions.h"
@@ -23,15 +25,23 @@
 #include "net/url_request/url_request.h"
 #include "third_party/blink/public/common/loader/network_utils.h"
 #include "third_party/blink/public/common/loader/referrer_utils.h"
-#include "third_party/re2/src/re2/re2.h"
 
 namespace brave {
 
 namespace {
 
-const std::string& GetQueryStringTrackers() {
-  static const base::NoDestructor<std::string> trackers(base::JoinString(
-      std::vector<std::string>(
+struct CaseInsensitiveCompare {
+  bool operator()(base::StringPiece a, base::StringPiece b) const {
+    return base::CompareCaseInsensitiveASCII(a, b) < 0;
+  }
+};
+
+using QueryStringTrackers =
+    base::flat_set<base::StringPiece, CaseInsensitiveCompare>;
+
+const QueryStringTrackers& GetQueryStringTrackers() {
+  static const base::NoDestructor<QueryStringTrackers> trackers(
+      std::vector<base::StringPiece>(
           {// https://github.com/brave/brave-browser/issues/4239
            "fbclid", "gclid", "msclkid", "mc_eid",
            // https://github.com/brave/brave-browser/issues/9879
@@ -47,40 +57,60 @@ const std::string& GetQueryStringTrackers() {
            // https://github.com/brave/brave-browser/issues/11578
            "yclid",
            // https://github.com/brave/brave-browser/issues/9019
-           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}),
-      "|"));
+           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}));
   return *trackers;
 }
 
-// From src/components/autofill/content/renderer/page_passwords_analyser.cc
-// and password_form_conversion_utils.cc:
-#define DECLARE_LAZY_MATCHER(NAME, PATTERN)                                   \
-  struct LabelPatternLazyInstanceTraits_##NAME                                \
-      : public base::internal::DestructorAtExitLazyInstanceTraits<re2::RE2> { \
-    static re2::RE2* New(void* instance) {                                    \
-      re2::RE2::Options options;                                              \
-      options.set_case_sensitive(false);                                      \
-      re2::RE2* matcher = new (instance) re2::RE2(PATTERN, options);          \
-      DCHECK(matcher->ok());                                                  \
-      return matcher;                                                         \
-    }                                                                         \
-  };                                                                          \
-  base::LazyInstance<re2::RE2, LabelPatternLazyInstanceTraits_##NAME> NAME =  \
-      LAZY_INSTANCE_INITIALIZER
-
-// e.g. "?fbclid=1234"
-DECLARE_LAZY_MATCHER(tracker_only_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+$");
-
-// e.g. "?fbclid=1234&foo=1"
-DECLARE_LAZY_MATCHER(tracker_first_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+&");
-
-// e.g. "?foo=1&fbclid=1234" or "?foo=1&fbclid=1234&bar=2"
-DECLARE_LAZY_MATCHER(tracker_appended_matcher,
-                     "&(" + GetQueryStringTrackers() + ")=[^&]+");
-
-#undef DECLARE_LAZY_MATCHER
+// A parameter is a tracker if its key is in the list and it has a non-empty
+// value, e.g. "fbclid=1234" but not "fbclid" or "fbclid=".
+bool IsTrackerParameter(base::StringPiece parameter) {
+  const size_t pos = parameter.find('=');
+  if (pos == base::StringPiece::npos || pos + 1 == parameter.size()) {
+    return false;
+  }
+  return GetQueryStringTrackers().contains(parameter.substr(0, pos));
+}
+
+// Returns true and sets |new_query| if any tracker parameters were removed
+// from |query|. Nothing is allocated when the query contains no trackers.
+bool StripQueryStringTrackers(base::StringPiece query, std::string* new_query) {
+  DCHECK(new_query);
+
+  bool found_tracker = false;
+  size_t start = 0;
+  while (start <= query.size()) {
+    size_t end = query.find('&', start);
+    if (end == base::StringPiece::npos) {
+      end = query.size();
+    }
+    if (IsTrackerParameter(query.substr(start, end - start))) {
+      found_tracker = true;
+      break;
+    }
+    start = end + 1;
+  }
+
+  if (!found_tracker) {
+    return false;
+  }
+
+  new_query->clear();
+  new_query->reserve(query.size());
+  bool first = true;
+  for (const base::StringPiece parameter : base::SplitStringPiece(
+           query, "&", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL)) {
+    if (IsTrackerParameter(parameter)) {
+      continue;
+    }
+    if (!first) {
+      new_query->push_back('&');
+    }
+    new_query->append(parameter.data(), parameter.size());
+    first = false;
+  }
+
+  return true;
+}
 
 void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.SiteHacks.QueryFilter");
@@ -106,14 +136,8 @@ void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
     return;
   }
 
-  std::string new_query = ctx->request_url.query();
-  // Note: the ordering of these replacements is important.
-  const int replacement_count =
-      re2::RE2::GlobalReplace(&new_query, tracker_appended_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_first_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_only_matcher.Get(), "");
-
-  if (replacement_count > 0) {
+  std::string new_query;
+  if (StripQueryStringTrackers(ctx->request_url.query_piece(), &new_query)) {
     url::Replacements<char> replacements;
     if (new_query.empty()) {
       replacements.ClearQuery();
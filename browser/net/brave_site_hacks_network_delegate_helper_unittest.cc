@@ -260,6 +260,9 @@ TEST(BraveSiteHacksNetworkDelegateHelperTest, QueryStringFiltered) {
            "https://example.com/?=2&?foo=yes&bar=2+"},
           {"https://example.com/?fbclid=1&a+b+c=some%20thing&1%202=3+4",
            "https://example.com/?a+b+c=some%20thing&1%202=3+4"},
+          // Tracker keys are matched case-insensitively:
+          {"https://example.com/?FBCLID=1&foo=1&HsCtaTracking=2",
+           "https://example.com/?foo=1"},
       });
   for (const auto& pair : urls) {
     auto brave_request_info =
@@ -17,7 +17,9 @@ namespace ipfs {
 int OnBeforeURLRequest_IPFSRedirectWork(
     const brave::ResponseCallback& next_callback,
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
-  if (!ctx->browser_context ||
+  // Only ipfs:// and ipns:// URIs are translated, so check the scheme before
+  // looking up prefs for every request.
+  if (!IsIPFSScheme(ctx->request_url) || !ctx->browser_context ||
       IsIpfsResolveMethodDisabled(ctx->browser_context)) {
     return net::OK;
   }
@@ -50,14 +52,14 @@ int OnHeadersReceived_IPFSRedirectWork(
     GURL* allowed_unsafe_redirect_url,
     const brave::ResponseCallback& next_callback,
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
-  if (!ctx->browser_context ||
+  if (!ctx->ipfs_auto_fallback || !response_headers ||
+      !ctx->browser_context ||
       IsIpfsResolveMethodDisabled(ctx->browser_context)) {
     return net::OK;
   }
 
   std::string ipfs_path;
-  if (ctx->ipfs_auto_fallback && response_headers &&
-      response_headers->GetNormalizedHeader("x-ipfs-path", &ipfs_path) &&
+  if (response_headers->GetNormalizedHeader("x-ipfs-path", &ipfs_path) &&
       // Make sure we don't infinite redirect
       !ctx->request_url.DomainIs(ctx->ipfs_gateway_url.host())) {
     GURL::Replacements replacements;
@@ -0,0 +1,56 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include "base/strings/string_piece.h"
+
+namespace brave {
+
+URLPatternHostIndex::URLPatternHostIndex(
+    const std::vector<URLPattern>& patterns) {
+  for (const auto& pattern : patterns) {
+    if (pattern.host().empty()) {
+      matches_all_hosts_ = true;
+    } else if (pattern.match_subdomains()) {
+      subdomain_hosts_.insert(pattern.host());
+    } else {
+      hosts_.insert(pattern.host());
+    }
+  }
+}
+
+URLPatternHostIndex::~URLPatternHostIndex() = default;
+
+bool URLPatternHostIndex::MayMatchHost(const GURL& url) const {
+  if (matches_all_hosts_) {
+    return true;
+  }
+
+  base::StringPiece host = url.host_piece();
+  if (!host.empty() && host.back() == '.') {
+    host.remove_suffix(1);
+  }
+
+  if (hosts_.contains(host)) {
+    return true;
+  }
+
+  // Try |host| and each of its parent domains against the wildcard hosts.
+  while (!host.empty()) {
+    if (subdomain_hosts_.contains(host)) {
+      return true;
+    }
+    const size_t pos = host.find('.');
+    if (pos == base::StringPiece::npos) {
+      break;
+    }
+    host.remove_prefix(pos + 1);
+  }
+
+  return false;
+}
+
+}  // namespace brave
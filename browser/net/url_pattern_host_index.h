@@ -0,0 +1,41 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+#define BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_set.h"
+#include "extensions/common/url_pattern.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+// Indexes the hosts of a fixed set of URLPatterns so that requests which
+// cannot match any of them are rejected with a few set lookups instead of
+// running every pattern.
+class URLPatternHostIndex {
+ public:
+  explicit URLPatternHostIndex(const std::vector<URLPattern>& patterns);
+  ~URLPatternHostIndex();
+
+  URLPatternHostIndex(const URLPatternHostIndex&) = delete;
+  URLPatternHostIndex& operator=(const URLPatternHostIndex&) = delete;
+
+  // Returns false only if no indexed pattern can match the host of |url|.
+  bool MayMatchHost(const GURL& url) const;
+
+ private:
+  bool matches_all_hosts_ = false;
+  base::flat_set<std::string, std::less<>> hosts_;
+  base::flat_set<std::string, std::less<>> subdomain_hosts_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_URL_PATTERN_HOST_INDEX_H_
@@ -0,0 +1,38 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/url_pattern_host_index.h"
+
+#include <vector>
+
+#include "extensions/common/url_pattern.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+using brave::URLPatternHostIndex;
+
+TEST(URLPatternHostIndexTest, MatchesExactAndSubdomainHosts) {
+  const URLPatternHostIndex index(std::vector<URLPattern>(
+      {URLPattern(URLPattern::SCHEME_HTTPS, "https://dl.google.com/*"),
+       URLPattern(URLPattern::SCHEME_HTTPS, "https://*.gvt1.com/*")}));
+
+  EXPECT_TRUE(index.MayMatchHost(GURL("https://dl.google.com/a")));
+  EXPECT_TRUE(index.MayMatchHost(GURL("https://dl.google.com./a")));
+  EXPECT_TRUE(index.MayMatchHost(GURL("https://gvt1.com/a")));
+  EXPECT_TRUE(index.MayMatchHost(GURL("https://r1.sn-n4v7sn7s.gvt1.com/a")));
+
+  EXPECT_FALSE(index.MayMatchHost(GURL("https://google.com/a")));
+  EXPECT_FALSE(index.MayMatchHost(GURL("https://sub.dl.google.com/a")));
+  EXPECT_FALSE(index.MayMatchHost(GURL("https://notgvt1.com/a")));
+  EXPECT_FALSE(index.MayMatchHost(GURL("https://gvt1.com.example.com/a")));
+  EXPECT_FALSE(index.MayMatchHost(GURL()));
+}
+
+TEST(URLPatternHostIndexTest, MatchesAllHosts) {
+  const URLPatternHostIndex index(std::vector<URLPattern>(
+      {URLPattern(URLPattern::SCHEME_HTTPS, "https://*/*")}));
+
+  EXPECT_TRUE(index.MayMatchHost(GURL("https://example.com/")));
+}
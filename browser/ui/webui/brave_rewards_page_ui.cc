@@ -16,6 +16,7 @@
 #include "base/memory/weak_ptr.h"
 #include "base/time/time.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/values.h"
 #include "brave/common/webui_url_constants.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/brave_ads/browser/ads_service_factory.h"
@@ -79,6 +80,9 @@ class RewardsDOMHandler : public WebUIMessageHandler,
   void GetReconcileStamp(const base::ListValue* args);
   void SaveSetting(const base::ListValue* args);
   void OnPublisherList(ledger::type::PublisherInfoList list);
+  void SendContributeList(
+      ledger::type::PublisherInfoList list,
+      const bool only_if_changed);
   void OnExcludedSiteList(ledger::type::PublisherInfoList list);
   void ExcludePublisher(const base::ListValue* args);
   void RestorePublishers(const base::ListValue* args);
@@ -304,6 +308,10 @@ class RewardsDOMHandler : public WebUIMessageHandler,
 
   brave_rewards::RewardsService* rewards_service_;  // NOT OWNED
   brave_ads::AdsService* ads_service_;  // NOT OWNED
+
+  // Last auto-contribute list sent to the page
+  base::Value last_contribute_list_;
+
   base::WeakPtrFactory<RewardsDOMHandler> weak_factory_;
 
   DISALLOW_COPY_AND_ASSIGN(RewardsDOMHandler);
@@ -902,28 +910,40 @@ void RewardsDOMHandler::RestorePublisher(const base::ListValue *args) {
 }
 
 void RewardsDOMHandler::OnPublisherList(ledger::type::PublisherInfoList list) {
+  SendContributeList(std::move(list), false);
+}
+
+void RewardsDOMHandler::SendContributeList(
+    ledger::type::PublisherInfoList list,
+    const bool only_if_changed) {
   if (!web_ui()->CanCallJavascript()) {
     return;
   }
 
-  auto publishers = std::make_unique<base::ListValue>();
+  base::Value publishers(base::Value::Type::LIST);
   for (auto const& item : list) {
-    auto publisher = std::make_unique<base::DictionaryValue>();
-    publisher->SetString("id", item->id);
-    publisher->SetDouble("percentage", item->percent);
-    publisher->SetString("publisherKey", item->id);
-    publisher->SetInteger("status", static_cast<int>(item->status));
-    publisher->SetInteger("excluded", static_cast<int>(item->excluded));
-    publisher->SetString("name", item->name);
-    publisher->SetString("provider", item->provider);
-    publisher->SetString("url", item->url);
-    publisher->SetString("favIcon", item->favicon_url);
-    publishers->Append(std::move(publisher));
+    base::Value publisher(base::Value::Type::DICTIONARY);
+    publisher.SetStringKey("id", item->id);
+    publisher.SetDoubleKey("percentage", item->percent);
+    publisher.SetStringKey("publisherKey", item->id);
+    publisher.SetIntKey("status", static_cast<int>(item->status));
+    publisher.SetIntKey("excluded", static_cast<int>(item->excluded));
+    publisher.SetStringKey("name", item->name);
+    publisher.SetStringKey("provider", item->provider);
+    publisher.SetStringKey("url", item->url);
+    publisher.SetStringKey("favIcon", item->favicon_url);
+    publishers.Append(std::move(publisher));
+  }
+
+  if (only_if_changed && publishers == last_contribute_list_) {
+    return;
   }
 
   web_ui()->CallJavascriptFunctionUnsafe(
       "brave_rewards.contributeList",
-      *publishers);
+      publishers);
+
+  last_contribute_list_ = std::move(publishers);
 }
 
 void RewardsDOMHandler::OnExcludedSiteList(
@@ -1365,7 +1385,9 @@ void RewardsDOMHandler::OnPendingContributionSaved(
 void RewardsDOMHandler::OnPublisherListNormalized(
     brave_rewards::RewardsService* rewards_service,
     ledger::type::PublisherInfoList list) {
-  OnPublisherList(std::move(list));
+  // The list is normalized after every page visit, so only push it when it
+  // differs from the list the page already has
+  SendContributeList(std::move(list), true);
 }
 
 void RewardsDOMHandler::GetStatement(
@@ -5,72 +5,65 @@
 
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg.h"
 
-#include <algorithm>
 #include <cmath>
-#include <numeric>
 #include <utility>
+#include <vector>
 
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
 
 namespace {
 
-bool StandardiseFeatsNoOutliers(
-    std::array<double, standardise_feat_count>* features,
-    const std::array<double, standardise_feat_count>& means,
-    const std::array<double, standardise_feat_count>& scale) {
-  for (unsigned int i = 0; i < standardise_feat_count; i++) {
-    features->at(i) = (features->at(i) - means[i]) / scale[i];
-  }
-  for (unsigned int i = 0; i < standardise_feat_count; i++) {
-    if (features->at(i) > kOutlierThreshold ||
-        features->at(i) < -kOutlierThreshold) {
-      VLOG(2) << "Outlier feature " << feature_sequence.at(i) << " with value "
-              << features->at(i);
-      return true;
-    }
-  }
-  return false;
+// Maps feature names to their position in |feature_sequence|
+const base::flat_map<base::StringPiece, size_t>& GetFeatureIndices() {
+  static const base::NoDestructor<base::flat_map<base::StringPiece, size_t>>
+      feature_indices([] {
+        std::vector<std::pair<base::StringPiece, size_t>> indices;
+        indices.reserve(feature_count);
+        for (size_t i = 0; i < feature_count; i++)
+          indices.emplace_back(feature_sequence[i], i);
+        return base::flat_map<base::StringPiece, size_t>(std::move(indices));
+      }());
+  return *feature_indices;
 }
 
 }  // namespace
 
 double LinregPredictVector(const std::array<double, feature_count>& features) {
-  // Standardise numeric features
-  std::array<double, standardise_feat_count> numeric_features;
-  std::copy(features.begin(), features.begin() + standardise_feat_count,
-            numeric_features.begin());
-  bool has_outliers = StandardiseFeatsNoOutliers(
-      &numeric_features, standardise_feat_means, standardise_feat_scale);
-  if (has_outliers) {
-    VLOG(2) << "Feature set has outliers, return 0";
-    return 0;
+  // Standardise numeric features and accumulate the prediction in a single
+  // pass, bailing out on the first outlier
+  double log_prediction = model_intercept;
+  for (unsigned int i = 0; i < standardise_feat_count; i++) {
+    const double feature =
+        (features[i] - standardise_feat_means[i]) / standardise_feat_scale[i];
+    if (feature > kOutlierThreshold || feature < -kOutlierThreshold) {
+      VLOG(2) << "Outlier feature " << feature_sequence.at(i) << " with value "
+              << feature;
+      VLOG(2) << "Feature set has outliers, return 0";
+      return 0;
+    }
+    log_prediction += feature * model_coefficients[i];
   }
 
-  // Create a new feature vector to include all features
-  std::array<double, feature_count> standardised_features;
-  std::move(numeric_features.begin(), numeric_features.end(),
-            standardised_features.begin());
-  // Just copy the rest of the features as-is
-  std::copy(features.begin() + standardise_feat_count, features.end(),
-            standardised_features.begin() + standardise_feat_count);
+  // The rest of the features are used as-is
+  for (unsigned int i = standardise_feat_count; i < feature_count; i++)
+    log_prediction += features[i] * model_coefficients[i];
 
-  // Calculate the prediction
-  double log_prediction = std::inner_product(
-      standardised_features.begin(), standardised_features.end(),
-      model_coefficients.begin(), model_intercept);
   // We know the target is log-scaled but care about the absolute value
   return std::pow(10, log_prediction);
 }
 
 double LinregPredictNamed(const base::flat_map<std::string, double>& features) {
   std::array<double, feature_count> feature_vector{};
-  for (unsigned int i = 0; i < feature_count; i++) {
-    auto it = features.find(feature_sequence.at(i));
-    if (it != features.end())
-      feature_vector[i] = it->second;
+  const auto& feature_indices = GetFeatureIndices();
+  for (const auto& feature : features) {
+    auto it = feature_indices.find(feature.first);
+    if (it != feature_indices.end())
+      feature_vector[it->second] = feature.second;
   }
   return LinregPredictVector(feature_vector);
 }
@@ -51,6 +51,17 @@ TEST(BraveSavingsPredictorTest, HandlesEmptyFeatureset) {
   EXPECT_EQ(result, array_result);
 }
 
+TEST(BraveSavingsPredictorTest, IgnoresUnknownFeatures) {
+  base::flat_map<std::string, double> features;
+  features["adblockRequests"] = 3;
+  features["thirdParties.Unknown Entity.blocked"] = 1;
+  const double result = LinregPredictNamed(features);
+  std::array<double, feature_count> features_array{};
+  features_array[0] = 3;
+  const double array_result = LinregPredictVector(features_array);
+  EXPECT_EQ(result, array_result);
+}
+
 TEST(BraveSavingsPredictorTest, HandlesCompleteFeatureset) {
   base::flat_map<std::string, double> features;
   for (unsigned int i = 0; i < feature_count; i++) {
@@ -136,7 +136,7 @@ base::Optional<std::string> NamedThirdPartyRegistry::GetThirdParty(
     return base::nullopt;
 
   if (url.has_host()) {
-    auto domain_entry = entity_by_domain_.find(url.host());
+    auto domain_entry = entity_by_domain_.find(url.host_piece());
     if (domain_entry != entity_by_domain_.end())
       return domain_entry->second;
 
@@ -16,6 +16,7 @@
 #include "base/json/json_writer.h"
 #include "base/path_service.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/system/sys_info.h"
 #include "base/task/post_task.h"
@@ -36,7 +37,6 @@
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/page_navigator.h"
 #include "content/public/common/referrer.h"
-#include "extensions/common/url_pattern.h"
 #include "net/base/load_flags.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "services/network/public/cpp/resource_request.h"
@@ -82,6 +82,23 @@ std::string BuildReferralEndpoint(const std::string& path) {
                             path.c_str());
 }
 
+// Matches |url| against a referral partner |domain| the same way as an
+// "*://*.<domain>/*" URLPattern would, without building one per domain.
+bool MatchesReferralDomain(const GURL& url, base::StringPiece domain) {
+  if (!url.SchemeIsHTTPOrHTTPS())
+    return false;
+
+  if (domain.empty())
+    return true;
+
+  const base::StringPiece host = url.host_piece();
+  if (!base::EndsWith(host, domain, base::CompareCase::INSENSITIVE_ASCII))
+    return false;
+
+  return host.size() == domain.size() ||
+         host[host.size() - domain.size() - 1] == '.';
+}
+
 }  // namespace
 
 namespace brave {
@@ -188,13 +205,8 @@ bool BraveReferralsService::GetMatchingReferralHeaders(
       continue;
     }
     for (const auto& domain_value : domains_list->GetList()) {
-      URLPattern url_pattern(URLPattern::SCHEME_HTTPS |
-                             URLPattern::SCHEME_HTTP);
-      url_pattern.SetScheme("*");
-      url_pattern.SetHost(domain_value.GetString());
-      url_pattern.SetPath("/*");
-      url_pattern.SetMatchSubdomains(true);
-      if (!url_pattern.MatchesURL(url))
+      if (!domain_value.is_string() ||
+          !MatchesReferralDomain(url, domain_value.GetString()))
         continue;
       return headers_dict->GetAsDictionary(request_headers_dict);
     }
@@ -6,8 +6,8 @@
 #include "brave/components/brave_rewards/browser/logging_util.h"
 
 #include "base/i18n/time_formatting.h"
-#include "base/files/file_path.h"
 #include "base/logging.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/stringprintf.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/components/brave_rewards/browser/file_util.h"
@@ -79,6 +79,33 @@ std::string TimeFormatForLog(
       "MMM dd, YYYY h::mm::ss.S a"));
 }
 
+base::StringPiece GetBaseName(
+    const std::string& file) {
+  const size_t pos = file.find_last_of("/\\");
+  if (pos == std::string::npos) {
+    return file;
+  }
+
+  return base::StringPiece(file).substr(pos + 1);
+}
+
+void AppendLogEntry(
+    const std::string& formatted_time,
+    const std::string& file,
+    const int line,
+    const int verbose_level,
+    const std::string& message,
+    std::string* log_entries) {
+  DCHECK(log_entries);
+
+  base::StringAppendF(log_entries, "[%s:%s:", formatted_time.c_str(),
+      GetLogVerboseLevelName(verbose_level).c_str());
+  GetBaseName(file).AppendToString(log_entries);
+  base::StringAppendF(log_entries, "(%d)] ", line);
+  log_entries->append(message);
+  log_entries->append("\n");
+}
+
 }  // namespace
 
 bool InitializeLog(
@@ -120,24 +147,28 @@ bool WriteToLog(
   return true;
 }
 
-std::string FriendlyFormatLogEntry(
-    const base::Time& time,
-    const std::string& file,
-    const int line,
-    const int verbose_level,
-    const std::string& message) {
-  const std::string formatted_time = TimeFormatForLog(time);
-
-  const std::string verbose_level_name = GetLogVerboseLevelName(verbose_level);
-
-  const base::FilePath file_path = base::FilePath().AppendASCII(file);
-  const std::string filename = file_path.BaseName().MaybeAsASCII();
+std::string FriendlyFormatLogEntries(
+    const std::vector<DiagnosticLogEntry>& entries) {
+  std::string log_entries;
+
+  // The log timestamp has a resolution of a tenth of a second, so the ICU
+  // formatted time only needs to be recomputed when that changes
+  int64_t last_formatted_interval = -1;
+  std::string formatted_time;
+
+  for (const auto& entry : entries) {
+    const int64_t interval =
+        (entry.time - base::Time::UnixEpoch()).InMilliseconds() / 100;
+    if (interval != last_formatted_interval) {
+      formatted_time = TimeFormatForLog(entry.time);
+      last_formatted_interval = interval;
+    }
 
-  const std::string log_entry =
-      base::StringPrintf("[%s:%s:%s(%d)] %s\n", formatted_time.c_str(),
-          verbose_level_name.c_str(), filename.c_str(), line, message.c_str());
+    AppendLogEntry(formatted_time, entry.file, entry.line, entry.verbose_level,
+        entry.message, &log_entries);
+  }
 
-  return log_entry;
+  return log_entries;
 }
 
 }  // namespace brave_rewards
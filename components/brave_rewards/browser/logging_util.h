@@ -7,22 +7,30 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_BROWSER_LOGGING_UTIL_H_
 
 #include <string>
+#include <vector>
 
 #include "base/files/file_util.h"
 #include "base/time/time.h"
 
 namespace brave_rewards {
 
+struct DiagnosticLogEntry {
+  base::Time time;
+  std::string file;
+  int line;
+  int verbose_level;
+  std::string message;
+};
+
 bool InitializeLog(
     base::File* file,
     const base::FilePath& path);
 
-std::string FriendlyFormatLogEntry(
-    const base::Time& time,
-    const std::string& file,
-    const int line,
-    const int verbose_level,
-    const std::string& message);
+// Formats |entries| into a single string so that they can be written to the
+// log with one write. Entries logged within the same tenth of a second share
+// one formatted timestamp.
+std::string FriendlyFormatLogEntries(
+    const std::vector<DiagnosticLogEntry>& entries);
 
 bool WriteToLog(
     base::File* file,
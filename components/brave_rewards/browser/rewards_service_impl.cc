@@ -103,6 +103,9 @@ namespace {
 const int kDiagnosticLogMaxVerboseLevel = 6;
 const int kTailDiagnosticLogToNumLines = 20000;
 const int kDiagnosticLogMaxFileSize = 10 * (1024 * 1024);
+const size_t kDiagnosticLogMaxBufferSize = 64 * 1024;
+constexpr base::TimeDelta kDiagnosticLogFlushDelay =
+    base::TimeDelta::FromSeconds(1);
 const char pref_prefix[] = "brave.rewards";
 
 std::string URLMethodToRequestType(ledger::type::UrlMethod method) {
@@ -163,6 +166,25 @@ time_t GetCurrentTimestamp() {
   return base::Time::NowFromSystemTime().ToTimeT();
 }
 
+// Writes |entries| through a file handle of its own rather than the service's
+// |diagnostic_log_|, so it is safe to run after the service has been destroyed
+void AppendToDiagnosticLogOnFileTaskRunner(
+    const base::FilePath& path,
+    const std::vector<DiagnosticLogEntry>& entries) {
+  base::File file(path,
+      base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_APPEND);
+  if (!file.IsValid()) {
+    VLOG(0) << "Failed to open diagnostic log: "
+        << GetLastFileError(&file);
+    return;
+  }
+
+  if (!WriteToLog(&file, FriendlyFormatLogEntries(entries))) {
+    VLOG(0) << "Failed to write to diagnostic log: "
+        << GetLastFileError(&file);
+  }
+}
+
 std::string LoadOnFileTaskRunner(const base::FilePath& path) {
   std::string data;
   bool success = base::ReadFileToString(path, &data);
@@ -812,6 +834,17 @@ void RewardsServiceImpl::Shutdown() {
   }
   url_loaders_.clear();
 
+  // The file task runner blocks shutdown and may outlive this service, so
+  // pending entries must not be written through |this|
+  diagnostic_log_flush_timer_.Stop();
+  if (!diagnostic_log_entries_.empty()) {
+    file_task_runner_->PostTask(FROM_HERE,
+        base::BindOnce(&AppendToDiagnosticLogOnFileTaskRunner,
+            diagnostic_log_path_,
+            std::move(diagnostic_log_entries_)));
+    ClearDiagnosticLogEntries();
+  }
+
   bat_ledger_.reset();
   RewardsService::Shutdown();
 }
@@ -1372,6 +1405,8 @@ void RewardsServiceImpl::OnStopLedgerForCompleteReset(
     const ledger::type::Result result) {
   profile_->GetPrefs()->ClearPrefsWithPrefixSilently(pref_prefix);
 
+  ClearDiagnosticLogEntries();
+
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
       FROM_HERE,
@@ -2260,15 +2295,45 @@ void RewardsServiceImpl::DiagnosticLog(
     return;
   }
 
+  DiagnosticLogEntry entry;
+  entry.time = base::Time::Now();
+  entry.file = file;
+  entry.line = line;
+  entry.verbose_level = verbose_level;
+  entry.message = message;
+
+  diagnostic_log_entries_size_ += message.size();
+  diagnostic_log_entries_.push_back(std::move(entry));
+
+  if (diagnostic_log_entries_size_ >= kDiagnosticLogMaxBufferSize) {
+    FlushDiagnosticLog();
+    return;
+  }
+
+  if (!diagnostic_log_flush_timer_.IsRunning()) {
+    diagnostic_log_flush_timer_.Start(FROM_HERE, kDiagnosticLogFlushDelay,
+        base::BindOnce(&RewardsServiceImpl::FlushDiagnosticLog,
+            base::Unretained(this)));
+  }
+}
+
+void RewardsServiceImpl::FlushDiagnosticLog() {
+  diagnostic_log_flush_timer_.Stop();
+
+  if (diagnostic_log_entries_.empty()) {
+    return;
+  }
+
+  std::vector<DiagnosticLogEntry> entries;
+  entries.swap(diagnostic_log_entries_);
+  ClearDiagnosticLogEntries();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner,
           base::Unretained(this),
           diagnostic_log_path_,
           kTailDiagnosticLogToNumLines,
-          file,
-          line,
-          verbose_level,
-          message),
+          std::move(entries)),
       base::BindOnce(&RewardsServiceImpl::OnWriteToLogOnFileTaskRunner,
           AsWeakPtr()));
 }
@@ -2276,10 +2341,7 @@ void RewardsServiceImpl::DiagnosticLog(
 bool RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner(
     const base::FilePath& log_path,
     const int num_lines,
-    const std::string& file,
-    const int line,
-    const int verbose_level,
-    const std::string& message) {
+    const std::vector<DiagnosticLogEntry>& entries) {
   if (!InitializeLog(&diagnostic_log_, log_path)) {
     VLOG(0) << "Failed to initialize diagnostic log: "
         << GetLastFileError(&diagnostic_log_);
@@ -2287,12 +2349,9 @@ bool RewardsServiceImpl::WriteToDiagnosticLogOnFileTaskRunner(
     return false;
   }
 
-  const base::Time time = base::Time::Now();
-
-  const std::string log_entry =
-      FriendlyFormatLogEntry(time, file, line, verbose_level, message);
+  const std::string log_entries = FriendlyFormatLogEntries(entries);
 
-  if (!WriteToLog(&diagnostic_log_, log_entry)) {
+  if (!WriteToLog(&diagnostic_log_, log_entries)) {
     VLOG(0) << "Failed to write to diagnostic log: "
         << GetLastFileError(&diagnostic_log_);
 
@@ -2316,6 +2375,8 @@ void RewardsServiceImpl::OnWriteToLogOnFileTaskRunner(
 void RewardsServiceImpl::LoadDiagnosticLog(
       const int num_lines,
       LoadDiagnosticLogCallback callback) {
+  FlushDiagnosticLog();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::LoadDiagnosticLogOnFileTaskRunner,
           base::Unretained(this),
@@ -2348,8 +2409,16 @@ void RewardsServiceImpl::OnLoadDiagnosticLogOnFileTaskRunner(
   std::move(callback).Run(value);
 }
 
+void RewardsServiceImpl::ClearDiagnosticLogEntries() {
+  diagnostic_log_flush_timer_.Stop();
+  diagnostic_log_entries_.clear();
+  diagnostic_log_entries_size_ = 0;
+}
+
 void RewardsServiceImpl::ClearDiagnosticLog(
     ClearDiagnosticLogCallback callback) {
+  ClearDiagnosticLogEntries();
+
   base::PostTaskAndReplyWithResult(file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RewardsServiceImpl::ClearDiagnosticLogOnFileTaskRunner,
           base::Unretained(this),
@@ -3304,6 +3373,7 @@ void RewardsServiceImpl::ClearAllNotifications() {
 }
 
 void RewardsServiceImpl::CompleteReset(SuccessCallback callback) {
+  ClearDiagnosticLogEntries();
   resetting_rewards_ = true;
 
   auto* ads_service = brave_ads::AdsServiceFactory::GetForProfile(profile_);
@@ -3351,6 +3421,7 @@ void RewardsServiceImpl::WalletDisconnected(const std::string& wallet_type) {
 }
 
 void RewardsServiceImpl::DeleteLog(ledger::ResultCallback callback) {
+  ClearDiagnosticLogEntries();
   diagnostic_log_.Close();
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(),
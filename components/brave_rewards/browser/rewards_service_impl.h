@@ -20,9 +20,11 @@
 #include "base/memory/weak_ptr.h"
 #include "base/observer_list.h"
 #include "base/one_shot_event.h"
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "bat/ledger/ledger.h"
 #include "bat/ledger/ledger_client.h"
+#include "brave/components/brave_rewards/browser/logging_util.h"
 #include "brave/components/brave_rewards/browser/rewards_service.h"
 #include "brave/components/brave_rewards/browser/rewards_service_private_observer.h"
 #include "brave/components/greaselion/browser/buildflags/buildflags.h"
@@ -353,6 +355,7 @@ class RewardsServiceImpl : public RewardsService,
 
  private:
   friend class ::RewardsFlagBrowserTest;
+  friend class RewardsServiceTest;
 
   void OnConnectionClosed(const ledger::type::Result result);
 
@@ -584,13 +587,14 @@ class RewardsServiceImpl : public RewardsService,
       const int verbose_level,
       const std::string& message) override;
 
+  void FlushDiagnosticLog();
+
+  void ClearDiagnosticLogEntries();
+
   bool WriteToDiagnosticLogOnFileTaskRunner(
       const base::FilePath& log_path,
       const int num_lines,
-      const std::string& file,
-      const int line,
-      const int verbose_level,
-      const std::string& message);
+      const std::vector<DiagnosticLogEntry>& entries);
 
   void OnWriteToLogOnFileTaskRunner(
     const bool success);
@@ -783,6 +787,10 @@ class RewardsServiceImpl : public RewardsService,
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
   const base::FilePath diagnostic_log_path_;
   base::File diagnostic_log_;
+  // Log entries waiting to be written to |diagnostic_log_| in one batch
+  std::vector<DiagnosticLogEntry> diagnostic_log_entries_;
+  size_t diagnostic_log_entries_size_ = 0;
+  base::OneShotTimer diagnostic_log_flush_timer_;
   const base::FilePath ledger_state_path_;
   const base::FilePath publisher_state_path_;
   const base::FilePath publisher_info_db_path_;
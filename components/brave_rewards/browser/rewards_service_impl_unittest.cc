@@ -4,8 +4,12 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <map>
+#include <string>
 
+#include "base/bind.h"
 #include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/test/task_environment.h"
 #include "bat/ledger/mojom_structs.h"
 #include "brave/browser/brave_rewards/rewards_service_factory.h"
 #include "brave/components/brave_rewards/browser/rewards_service_impl.h"
@@ -76,11 +80,44 @@ class RewardsServiceTest : public testing::Test {
   RewardsServiceImpl* rewards_service() { return rewards_service_; }
   MockRewardsServiceObserver* observer() { return observer_.get(); }
 
+  void DiagnosticLog(const std::string& message) {
+    rewards_service_->should_persist_logs_ = true;
+    rewards_service_->DiagnosticLog(__FILE__, __LINE__, 0, message);
+  }
+
+  void DeleteLog() {
+    base::RunLoop run_loop;
+    rewards_service_->DeleteLog(
+        [&run_loop](const ledger::type::Result result) {
+          EXPECT_EQ(ledger::type::Result::LEDGER_OK, result);
+          run_loop.Quit();
+        });
+    run_loop.Run();
+  }
+
+  std::string LoadDiagnosticLog() {
+    std::string log;
+    base::RunLoop run_loop;
+    rewards_service_->LoadDiagnosticLog(100,
+        base::BindOnce([](base::RunLoop* run_loop, std::string* log,
+            const std::string& value) {
+          *log = value;
+          run_loop->Quit();
+        }, &run_loop, &log));
+    run_loop.Run();
+    return log;
+  }
+
+  void FastForwardBy(const base::TimeDelta time_delta) {
+    task_environment_.FastForwardBy(time_delta);
+  }
+
  private:
   // Need this as a very first member to run tests in UI thread
   // When this is set, class should not install any other MessageLoops, like
   // base::test::ScopedTaskEnvironment
-  content::BrowserTaskEnvironment task_environment_;
+  content::BrowserTaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   std::unique_ptr<Profile> profile_;
   RewardsServiceImpl* rewards_service_;
   std::unique_ptr<MockRewardsServiceObserver> observer_;
@@ -89,4 +126,13 @@ class RewardsServiceTest : public testing::Test {
 
 // add test for strange entries
 
+TEST_F(RewardsServiceTest, DeleteLogDropsBufferedEntries) {
+  DiagnosticLog("buffered before the log was deleted");
+
+  DeleteLog();
+  FastForwardBy(base::TimeDelta::FromSeconds(5));
+
+  EXPECT_TRUE(LoadDiagnosticLog().empty());
+}
+
 }  // namespace brave_rewards
@@ -64,12 +64,12 @@ class AdBlockBaseService : public BaseBraveShieldsService {
   void AddKnownTagsToAdBlockInstance();
   void AddKnownResourcesToAdBlockInstance();
   void ResetForTest(const std::string& rules, const std::string& resources);
+  void UpdateAdBlockClient(
+      std::unique_ptr<adblock::Engine> ad_block_client);
 
   std::unique_ptr<adblock::Engine> ad_block_client_;
 
  private:
-  void UpdateAdBlockClient(
-      std::unique_ptr<adblock::Engine> ad_block_client);
   void OnGetDATFileData(GetDATFileDataResult result);
   void OnPreferenceChanges(const std::string& pref_name);
 
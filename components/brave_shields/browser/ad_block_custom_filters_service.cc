@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 
+#include <memory>
+
 #include "base/logging.h"
 #include "brave/browser/brave_browser_process_impl.h"
 #include "brave/common/pref_names.h"
@@ -25,7 +27,12 @@ AdBlockCustomFiltersService::~AdBlockCustomFiltersService() {
 }
 
 bool AdBlockCustomFiltersService::Init() {
-  return UpdateCustomFilters(GetCustomFilters());
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (!g_browser_process->local_state())
+    return false;
+
+  UpdateCustomFiltersEngine(GetCustomFilters());
+  return true;
 }
 
 std::string AdBlockCustomFiltersService::GetCustomFilters() {
@@ -42,21 +49,34 @@ bool AdBlockCustomFiltersService::UpdateCustomFilters(
   PrefService* local_state = g_browser_process->local_state();
   if (!local_state)
     return false;
+
+  // Saving unchanged filters would otherwise rebuild the whole engine and
+  // stall the ad-block task runner for nothing.
+  if (custom_filters == local_state->GetString(kAdBlockCustomFilters))
+    return true;
+
   local_state->SetString(kAdBlockCustomFilters, custom_filters);
+  UpdateCustomFiltersEngine(custom_filters);
 
+  return true;
+}
+
+void AdBlockCustomFiltersService::UpdateCustomFiltersEngine(
+    const std::string& custom_filters) {
   GetTaskRunner()->PostTask(
       FROM_HERE,
       base::BindOnce(
           &AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner,
           base::Unretained(this), custom_filters));
-
-  return true;
 }
 
 void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
     const std::string& custom_filters) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  // Swap through |UpdateAdBlockClient| so that enabled tags and resources
+  // carry over to the new engine.
+  UpdateAdBlockClient(
+      std::make_unique<adblock::Engine>(custom_filters.c_str()));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
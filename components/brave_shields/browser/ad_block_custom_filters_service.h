@@ -32,6 +32,7 @@ class AdBlockCustomFiltersService : public AdBlockBaseService {
 
  private:
   friend class ::AdBlockServiceTest;
+  void UpdateCustomFiltersEngine(const std::string& custom_filters);
   void UpdateCustomFiltersOnFileTaskRunner(const std::string& custom_filters);
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockCustomFiltersService);
@@ -204,7 +204,7 @@ AdBlockRegionalServiceManager::UrlCosmeticResources(
   base::Optional<base::Value> first_value =
       it->second->UrlCosmeticResources(url);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for (it++; it != regional_services_.end(); it++) {
     base::Optional<base::Value> next_value =
         it->second->UrlCosmeticResources(url);
     if (first_value) {
@@ -232,7 +232,7 @@ AdBlockRegionalServiceManager::HiddenClassIdSelectors(
   base::Optional<base::Value> first_value =
       it->second->HiddenClassIdSelectors(classes, ids, exceptions);
 
-  for ( ; it != regional_services_.end(); it++) {
+  for (it++; it != regional_services_.end(); it++) {
     base::Optional<base::Value> next_value =
         it->second->HiddenClassIdSelectors(classes, ids, exceptions);
     if (first_value && first_value->is_list()) {
@@ -61,7 +61,7 @@ bool HasIPFSPath(const GURL& gurl) {
        URLPattern(URLPattern::SCHEME_ALL, "*://*/ipns/*")});
   return std::any_of(
       url_patterns.begin(), url_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+      [&gurl](const URLPattern& pattern) { return pattern.MatchesURL(gurl); });
 }
 
 bool IsDefaultGatewayURL(const GURL& url, content::BrowserContext* context) {
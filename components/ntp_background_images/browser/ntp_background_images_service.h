@@ -106,6 +106,8 @@ class NTPBackgroundImagesService {
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, BasicTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BasicSuperReferralDataTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
+                           ClearCachedImagesOnUpdateTest);
 
   void OnComponentReady(bool is_super_referral,
                         const base::FilePath& installed_dir);
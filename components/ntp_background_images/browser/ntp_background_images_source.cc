@@ -24,6 +24,10 @@ namespace ntp_background_images {
 
 namespace {
 
+// Holds a few wallpapers and their logos.
+constexpr size_t kMaxCachedImageCount = 8;
+constexpr size_t kMaxCachedImageBytes = 16 * 1024 * 1024;
+
 base::Optional<std::string> ReadFileToString(const base::FilePath& path) {
   std::string contents;
   if (!base::ReadFileToString(path, &contents))
@@ -40,10 +44,14 @@ bool IsSuperReferralPath(const std::string& path) {
 NTPBackgroundImagesSource::NTPBackgroundImagesSource(
     NTPBackgroundImagesService* service)
     : service_(service),
+      image_cache_(ImageCache::NO_AUTO_EVICT),
       weak_factory_(this) {
+  service_->AddObserver(this);
 }
 
-NTPBackgroundImagesSource::~NTPBackgroundImagesSource() = default;
+NTPBackgroundImagesSource::~NTPBackgroundImagesSource() {
+  service_->RemoveObserver(this);
+}
 
 std::string NTPBackgroundImagesSource::GetSource() {
   return kBrandedWallpaperHost;
@@ -64,7 +72,7 @@ void NTPBackgroundImagesSource::StartDataRequest(
 
   // Favicon data is fetched from cached folder not from component data.
   if (IsTopSiteFaviconPath(path)) {
-    GetImageFile(GetTopSiteFaviconFilePath(path), std::move(callback));
+    GetImageFile(GetTopSiteFaviconFilePath(path), false, std::move(callback));
     return;
   }
 
@@ -92,32 +100,83 @@ void NTPBackgroundImagesSource::StartDataRequest(
         images_data->backgrounds[GetWallpaperIndexFromPath(path)].image_file;
   }
 
-  GetImageFile(image_file_path, std::move(callback));
+  GetImageFile(image_file_path, true, std::move(callback));
 }
 
 void NTPBackgroundImagesSource::GetImageFile(
     const base::FilePath& image_file_path,
+    bool should_cache,
     GotDataCallback callback) {
+  if (should_cache) {
+    auto it = image_cache_.Get(image_file_path);
+    if (it != image_cache_.end()) {
+      std::move(callback).Run(it->second);
+      return;
+    }
+  }
+
   base::PostTaskAndReplyWithResult(
       FROM_HERE, {base::ThreadPool(), base::MayBlock()},
       base::BindOnce(&ReadFileToString, image_file_path),
       base::BindOnce(&NTPBackgroundImagesSource::OnGotImageFile,
                      weak_factory_.GetWeakPtr(),
-                     std::move(callback)));
+                     std::move(callback),
+                     image_file_path,
+                     should_cache));
 }
 
 void NTPBackgroundImagesSource::OnGotImageFile(
     GotDataCallback callback,
+    const base::FilePath& image_file_path,
+    bool should_cache,
     base::Optional<std::string> input) {
-  if (!input)
+  if (!input) {
+    std::move(callback).Run(scoped_refptr<base::RefCountedMemory>());
     return;
+  }
 
-  scoped_refptr<base::RefCountedMemory> bytes;
-  bytes = new base::RefCountedBytes(
-       reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
+  scoped_refptr<base::RefCountedMemory> bytes =
+      base::RefCountedString::TakeString(&input.value());
+  if (should_cache)
+    CacheImage(image_file_path, bytes);
   std::move(callback).Run(std::move(bytes));
 }
 
+void NTPBackgroundImagesSource::CacheImage(
+    const base::FilePath& image_file_path,
+    scoped_refptr<base::RefCountedMemory> bytes) {
+  if (bytes->size() > kMaxCachedImageBytes)
+    return;
+
+  auto it = image_cache_.Peek(image_file_path);
+  if (it != image_cache_.end())
+    image_cache_size_ -= it->second->size();
+
+  image_cache_size_ += bytes->size();
+  image_cache_.Put(image_file_path, std::move(bytes));
+
+  while (image_cache_.size() > kMaxCachedImageCount ||
+         image_cache_size_ > kMaxCachedImageBytes) {
+    auto oldest = image_cache_.rbegin();
+    image_cache_size_ -= oldest->second->size();
+    image_cache_.Erase(oldest);
+  }
+}
+
+void NTPBackgroundImagesSource::ClearImageCache() {
+  image_cache_.Clear();
+  image_cache_size_ = 0;
+}
+
+void NTPBackgroundImagesSource::OnUpdated(NTPBackgroundImagesData* data) {
+  // Images of the previous component version are not served anymore.
+  ClearImageCache();
+}
+
+void NTPBackgroundImagesSource::OnSuperReferralEnded() {
+  ClearImageCache();
+}
+
 std::string NTPBackgroundImagesSource::GetMimeType(const std::string& path) {
   if (IsLogoPath(path) || IsTopSiteFaviconPath(path))
     return "image/png";
@@ -8,20 +8,19 @@
 
 #include <string>
 
+#include "base/containers/mru_cache.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
 #include "base/optional.h"
+#include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "content/public/browser/url_data_source.h"
 
-namespace base {
-class FilePath;
-}  // namespace base
-
 namespace ntp_background_images {
 
-class NTPBackgroundImagesService;
-
 // This serves background image data.
-class NTPBackgroundImagesSource : public content::URLDataSource {
+class NTPBackgroundImagesSource : public content::URLDataSource,
+                                  public NTPBackgroundImagesService::Observer {
  public:
   explicit NTPBackgroundImagesSource(NTPBackgroundImagesService* service);
 
@@ -32,9 +31,17 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
       const NTPBackgroundImagesSource&) = delete;
 
  private:
+  using ImageCache =
+      base::MRUCache<base::FilePath, scoped_refptr<base::RefCountedMemory>>;
+
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, BasicTest);
   FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
                            BasicSuperReferralDataTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest, CachedImageTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
+                           CachedImageSizeLimitTest);
+  FRIEND_TEST_ALL_PREFIXES(NTPBackgroundImagesSourceTest,
+                           ClearCachedImagesOnUpdateTest);
 
   // content::URLDataSource overrides:
   std::string GetSource() override;
@@ -44,10 +51,20 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   std::string GetMimeType(const std::string& path) override;
   bool AllowCaching() override;
 
+  // NTPBackgroundImagesService::Observer overrides:
+  void OnUpdated(NTPBackgroundImagesData* data) override;
+  void OnSuperReferralEnded() override;
+
   void GetImageFile(const base::FilePath& image_file_path,
+                    bool should_cache,
                     GotDataCallback callback);
   void OnGotImageFile(GotDataCallback callback,
+                      const base::FilePath& image_file_path,
+                      bool should_cache,
                       base::Optional<std::string> input);
+  void CacheImage(const base::FilePath& image_file_path,
+                  scoped_refptr<base::RefCountedMemory> bytes);
+  void ClearImageCache();
   bool IsValidPath(const std::string& path) const;
   bool IsLogoPath(const std::string& path) const;
   bool IsDefaultLogoPath(const std::string& path) const;
@@ -58,6 +75,11 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   base::FilePath GetTopSiteFaviconFilePath(const std::string& path) const;
 
   NTPBackgroundImagesService* service_;  // not owned
+  // Recently served wallpapers and logos, so opening many new tabs doesn't
+  // re-read the same multi-megabyte files. Bounded by entry count and total
+  // size, and cleared whenever the service replaces its images data.
+  ImageCache image_cache_;
+  size_t image_cache_size_ = 0;
   base::WeakPtrFactory<NTPBackgroundImagesSource> weak_factory_;
 };
 
@@ -6,6 +6,10 @@
 #include <memory>
 #include <string>
 
+#include "base/bind.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_referrals/browser/brave_referrals_service.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
@@ -144,4 +148,61 @@ TEST_F(NTPBackgroundImagesSourceTest, BasicSuperReferralDataTest) {
 
 #endif  // ENABLE_BRAVE_REFERRALS
 
+TEST_F(NTPBackgroundImagesSourceTest, CachedImageTest) {
+  const base::FilePath image_file_path(FILE_PATH_LITERAL("wallpaper-0.jpg"));
+  std::string image_data = "image data";
+  scoped_refptr<base::RefCountedMemory> cached_bytes =
+      base::RefCountedString::TakeString(&image_data);
+  source_->CacheImage(image_file_path, cached_bytes);
+
+  // Cached images are served without reading the file.
+  scoped_refptr<base::RefCountedMemory> result;
+  source_->GetImageFile(
+      image_file_path, true,
+      base::BindOnce(
+          [](scoped_refptr<base::RefCountedMemory>* result,
+             scoped_refptr<base::RefCountedMemory> bytes) {
+            *result = std::move(bytes);
+          },
+          &result));
+  ASSERT_TRUE(result);
+  EXPECT_EQ(cached_bytes.get(), result.get());
+}
+
+TEST_F(NTPBackgroundImagesSourceTest, CachedImageSizeLimitTest) {
+  // Two 6MB wallpapers fit in the cache but a third evicts the oldest.
+  for (int i = 0; i < 3; ++i) {
+    std::string image_data(6 * 1024 * 1024, 'x');
+    source_->CacheImage(
+        base::FilePath::FromUTF8Unsafe(base::StringPrintf("wallpaper-%d.jpg",
+                                                          i)),
+        base::RefCountedString::TakeString(&image_data));
+  }
+
+  EXPECT_EQ(2u, source_->image_cache_.size());
+  EXPECT_EQ(12u * 1024 * 1024, source_->image_cache_size_);
+  EXPECT_EQ(source_->image_cache_.end(),
+            source_->image_cache_.Peek(
+                base::FilePath(FILE_PATH_LITERAL("wallpaper-0.jpg"))));
+
+  // An image larger than the whole cache is not cached.
+  std::string image_data(32 * 1024 * 1024, 'x');
+  source_->CacheImage(base::FilePath(FILE_PATH_LITERAL("wallpaper-3.jpg")),
+                      base::RefCountedString::TakeString(&image_data));
+  EXPECT_EQ(2u, source_->image_cache_.size());
+  EXPECT_EQ(12u * 1024 * 1024, source_->image_cache_size_);
+}
+
+TEST_F(NTPBackgroundImagesSourceTest, ClearCachedImagesOnUpdateTest) {
+  std::string image_data = "image data";
+  source_->CacheImage(base::FilePath(FILE_PATH_LITERAL("wallpaper-0.jpg")),
+                      base::RefCountedString::TakeString(&image_data));
+  ASSERT_EQ(1u, source_->image_cache_.size());
+
+  // Images of the previous component version must not be served anymore.
+  service_->OnGetComponentJsonData(false, "{}");
+  EXPECT_EQ(0u, source_->image_cache_.size());
+  EXPECT_EQ(0u, source_->image_cache_size_);
+}
+
 }  // namespace ntp_background_images
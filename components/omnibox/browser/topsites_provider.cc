@@ -9,7 +9,10 @@
 
 #include <algorithm>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
 #include "brave/common/pref_names.h"
@@ -17,6 +20,31 @@
 #include "components/omnibox/browser/history_provider.h"
 #include "components/prefs/pref_service.h"
 
+namespace {
+
+// Length of the substrings used to index |TopSitesProvider::top_sites_|.
+constexpr size_t kNGramLength = 3;
+
+// Maps each |kNGramLength| character substring to the indices of the sites
+// containing it, in the sites' original order.
+using NGramIndex = std::unordered_map<std::string, std::vector<size_t>>;
+
+NGramIndex BuildNGramIndex(const std::vector<std::string>& sites) {
+  NGramIndex index;
+  for (size_t i = 0; i < sites.size(); ++i) {
+    const std::string& site = sites[i];
+    for (size_t pos = 0; pos + kNGramLength <= site.length(); ++pos) {
+      std::vector<size_t>& site_indices = index[site.substr(pos, kNGramLength)];
+      // A site may contain the same n-gram more than once.
+      if (site_indices.empty() || site_indices.back() != i)
+        site_indices.push_back(i);
+    }
+  }
+  return index;
+}
+
+}  // namespace
+
 // As from autocomplete_provider.h:
 // Search Secondary Provider (suggestion)                              |  100++
 const int TopSitesProvider::kRelevance = 100;
@@ -42,10 +70,27 @@ void TopSitesProvider::Start(const AutocompleteInput& input,
   const std::string input_text =
       base::ToLowerASCII(base::UTF16ToUTF8(input.text()));
 
-  for (std::vector<std::string>::const_iterator i = top_sites_.begin();
-       (i != top_sites_.end()) && (matches_.size() < provider_max_matches());
-       ++i) {
-    const std::string &current_site = *i;
+  // Every site containing |input_text| contains all of its n-grams, so only
+  // the sites listed for its rarest n-gram need to be searched.
+  const std::vector<size_t>* candidates = nullptr;
+  if (input_text.length() >= kNGramLength) {
+    static const base::NoDestructor<NGramIndex> index(
+        BuildNGramIndex(top_sites_));
+    for (size_t pos = 0; pos + kNGramLength <= input_text.length(); ++pos) {
+      const auto it = index->find(input_text.substr(pos, kNGramLength));
+      if (it == index->end())
+        return;
+      if (!candidates || it->second.size() < candidates->size())
+        candidates = &it->second;
+    }
+  }
+
+  const size_t candidate_count =
+      candidates ? candidates->size() : top_sites_.size();
+  for (size_t i = 0;
+       i < candidate_count && matches_.size() < provider_max_matches(); ++i) {
+    const std::string& current_site =
+        top_sites_[candidates ? (*candidates)[i] : i];
     size_t foundPos = current_site.find(input_text);
     if (std::string::npos != foundPos) {
       ACMatchClassifications styles =
@@ -56,3 +56,17 @@ TEST_F(TopSitesProviderTest, NoMatchingWhenPrefIsOff) {
   provider_->Start(CreateAutocompleteInput("dex"), false);
   EXPECT_TRUE(provider_->matches().empty());
 }
+
+// Checks that inputs long enough to use the n-gram index still match in the
+// middle of a site.
+TEST_F(TopSitesProviderTest, MatchesSubstringInsideSite) {
+  provider_->Start(CreateAutocompleteInput("oogle"), false);
+  ASSERT_FALSE(provider_->matches().empty());
+  for (const auto& match : provider_->matches()) {
+    EXPECT_NE(base::string16::npos,
+              match.contents.find(base::ASCIIToUTF16("oogle")));
+  }
+
+  provider_->Start(CreateAutocompleteInput("qqqzzz"), false);
+  EXPECT_TRUE(provider_->matches().empty());
+}
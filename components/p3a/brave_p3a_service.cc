@@ -408,12 +408,8 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
   // Shortcut for the special values, see |kSuspendedMetricValue|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                   base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this,
-                                  histogram_name,
-                                  kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    SetPendingHistogramValue(histogram_name, kSuspendedMetricValue,
+                             kSuspendedMetricBucket);
     return;
   }
 
@@ -442,12 +438,43 @@ void BraveP3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  SetPendingHistogramValue(histogram_name, sample, bucket);
 }
 
-void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
+void BraveP3AService::SetPendingHistogramValue(
+    base::StringPiece histogram_name,
+    base::HistogramBase::Sample sample,
+    size_t bucket) {
+  bool flush_pending;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    flush_pending = !pending_histogram_values_.empty();
+    pending_histogram_values_[histogram_name] = {sample, bucket};
+  }
+
+  if (flush_pending) {
+    return;
+  }
+
+  base::PostTask(
+      FROM_HERE, {content::BrowserThread::UI},
+      base::BindOnce(&BraveP3AService::FlushPendingHistogramValuesOnUI, this));
+}
+
+void BraveP3AService::FlushPendingHistogramValuesOnUI() {
+  PendingHistogramValues values;
+  {
+    base::AutoLock lock(pending_histogram_values_lock_);
+    values.swap(pending_histogram_values_);
+  }
+
+  for (const auto& entry : values) {
+    OnHistogramChangedOnUI(entry.first, entry.second.first,
+                           entry.second.second);
+  }
+}
+
+void BraveP3AService::OnHistogramChangedOnUI(base::StringPiece histogram_name,
                                              base::HistogramBase::Sample sample,
                                              size_t bucket) {
   VLOG(2) << "BraveP3AService::OnHistogramChanged: histogram_name = "
@@ -8,10 +8,12 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 
 #include "base/containers/flat_map.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
+#include "base/synchronization/lock.h"
 #include "base/timer/timer.h"
 #include "brave/components/brave_prochlo/brave_prochlo_message.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
@@ -73,7 +75,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
-  void OnHistogramChangedOnUI(const char* histogram_name,
+  // Stores the latest value of a histogram and posts
+  // |FlushPendingHistogramValuesOnUI()| unless a flush is already pending.
+  void SetPendingHistogramValue(base::StringPiece histogram_name,
+                                base::HistogramBase::Sample sample,
+                                size_t bucket);
+
+  void FlushPendingHistogramValuesOnUI();
+
+  void OnHistogramChangedOnUI(base::StringPiece histogram_name,
                               base::HistogramBase::Sample sample,
                               size_t bucket);
 
@@ -109,6 +119,15 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Latest sample and bucket of each histogram changed since the last flush
+  // to UI thread. Only the latest value of a metric is reported, so samples
+  // recorded in between are coalesced rather than posted one task each.
+  using PendingHistogramValues = base::flat_map<
+      base::StringPiece,
+      std::pair<base::HistogramBase::Sample, size_t>>;
+  base::Lock pending_histogram_values_lock_;
+  PendingHistogramValues pending_histogram_values_;
+
   // Once fired we restart the overall uploading process.
   base::OneShotTimer rotation_timer_;
 
@@ -224,42 +224,72 @@ void BatLedgerClientMojoBridge::ClearState(const std::string& name) {
 
 bool BatLedgerClientMojoBridge::GetBooleanOption(
     const std::string& name) const {
-  bool value;
-  bat_ledger_client_->GetBooleanOption(name, &value);
+  const auto iter = bool_options_.find(name);
+  if (iter != bool_options_.end())
+    return iter->second;
+
+  bool value = false;
+  if (bat_ledger_client_->GetBooleanOption(name, &value))
+    bool_options_[name] = value;
   return value;
 }
 
 int BatLedgerClientMojoBridge::GetIntegerOption(const std::string& name) const {
-  int value;
-  bat_ledger_client_->GetIntegerOption(name, &value);
+  const auto iter = integer_options_.find(name);
+  if (iter != integer_options_.end())
+    return iter->second;
+
+  int value = 0;
+  if (bat_ledger_client_->GetIntegerOption(name, &value))
+    integer_options_[name] = value;
   return value;
 }
 
 double BatLedgerClientMojoBridge::GetDoubleOption(
     const std::string& name) const {
-  double value;
-  bat_ledger_client_->GetDoubleOption(name, &value);
+  const auto iter = double_options_.find(name);
+  if (iter != double_options_.end())
+    return iter->second;
+
+  double value = 0.0;
+  if (bat_ledger_client_->GetDoubleOption(name, &value))
+    double_options_[name] = value;
   return value;
 }
 
 std::string BatLedgerClientMojoBridge::GetStringOption(
     const std::string& name) const {
+  const auto iter = string_options_.find(name);
+  if (iter != string_options_.end())
+    return iter->second;
+
   std::string value;
-  bat_ledger_client_->GetStringOption(name, &value);
+  if (bat_ledger_client_->GetStringOption(name, &value))
+    string_options_[name] = value;
   return value;
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64Option(
     const std::string& name) const {
-  int64_t value;
-  bat_ledger_client_->GetInt64Option(name, &value);
+  const auto iter = int64_options_.find(name);
+  if (iter != int64_options_.end())
+    return iter->second;
+
+  int64_t value = 0;
+  if (bat_ledger_client_->GetInt64Option(name, &value))
+    int64_options_[name] = value;
   return value;
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64Option(
     const std::string& name) const {
-  uint64_t value;
-  bat_ledger_client_->GetUint64Option(name, &value);
+  const auto iter = uint64_options_.find(name);
+  if (iter != uint64_options_.end())
+    return iter->second;
+
+  uint64_t value = 0;
+  if (bat_ledger_client_->GetUint64Option(name, &value))
+    uint64_options_[name] = value;
   return value;
 }
 
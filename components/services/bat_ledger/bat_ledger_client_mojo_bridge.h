@@ -128,6 +128,15 @@ class BatLedgerClientMojoBridge :
   bool Connected() const;
 
   mojo::AssociatedRemote<mojom::BatLedgerClient> bat_ledger_client_;
+
+  // Options are static for the lifetime of the browser, so each one is only
+  // fetched over sync IPC once.
+  mutable std::map<std::string, bool> bool_options_;
+  mutable std::map<std::string, int> integer_options_;
+  mutable std::map<std::string, double> double_options_;
+  mutable std::map<std::string, std::string> string_options_;
+  mutable std::map<std::string, int64_t> int64_options_;
+  mutable std::map<std::string, uint64_t> uint64_options_;
 };
 
 }  // namespace bat_ledger
@@ -261,7 +261,7 @@ void ChromeImporter::ImportHistory() {
     row.typed_count = s.ColumnInt(3);
     row.visit_count = s.ColumnInt(4);
 
-    rows.push_back(row);
+    rows.push_back(std::move(row));
   }
 
   if (!rows.empty() && !cancelled())
@@ -367,26 +367,32 @@ void ChromeImporter::LoadFaviconData(
   if (!s.is_valid())
     return;
 
+  favicons->reserve(favicon_map.size());
+
+  // Reused for every favicon to avoid reallocating the blob buffer.
+  std::vector<unsigned char> data;
+
   for (FaviconMap::const_iterator i = favicon_map.begin();
-       i != favicon_map.end(); ++i) {
+       i != favicon_map.end() && !cancelled(); ++i) {
     s.BindInt64(0, i->first);
     if (s.Step()) {
       favicon_base::FaviconUsageData usage;
 
       usage.favicon_url = GURL(s.ColumnString(0));
-      if (!usage.favicon_url.is_valid())
+      if (!usage.favicon_url.is_valid()) {
+        s.Reset(true);
         continue;  // Don't bother importing favicons with invalid URLs.
+      }
 
-      std::vector<unsigned char> data;
       s.ColumnBlobAsVector(1, &data);
-      if (data.empty())
-        continue;  // Data definitely invalid.
-
-      if (!importer::ReencodeFavicon(&data[0], data.size(), &usage.png_data))
-        continue;  // Unable to decode.
+      if (data.empty() ||
+          !importer::ReencodeFavicon(&data[0], data.size(), &usage.png_data)) {
+        s.Reset(true);
+        continue;  // Data definitely invalid or unable to decode.
+      }
 
       usage.urls = i->second;
-      favicons->push_back(usage);
+      favicons->push_back(std::move(usage));
     }
     s.Reset(true);
   }